@@ -1,7 +1,19 @@
 #ifndef LIST_HPP
 #define LIST_HPP
 
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <initializer_list>
+#include <iterator>
 #include <memory>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 
 using std::invalid_argument;
 using std::shared_ptr;
@@ -16,7 +28,7 @@ private:
      * \brief Internal implementation of immutable list
      * which needs to be wrapped into public List.
      */
-    class List_ : public std::enable_shared_from_this<List_> {
+    class List_ {
     private:
         /**
          * Handy alias for List pointer wrapped into shared pointer.
@@ -56,24 +68,15 @@ private:
         /**
          * \param value Value to be inserted.
          * \param position Index of the inserted element in resulting list.
+         * Should be more than `0`.
          */
         ListPtr insert_(const T& value, const size_t position) const {
-            if (position == 0) {
-                return this->insertFirst(value);
-            } else if (position == this->size_) {
+            if (position == this->size_) {
                 return this->append(value);
             } else {
                 return this->insertMiddle(value, position);
             }
         }
-        /**
-         * \param value Value to be inserted.
-         * \return List with `value` in head and `this` in tail.
-         */
-        ListPtr insertFirst(const T& value) const {
-            return ListPtr{
-                new List_{value, this->shared_from_this()}, List_::destroy};
-        }
         /**
          * \param value Value to be inserted.
          * \param position Index that the `value` should have in new List.
@@ -89,53 +92,188 @@ private:
                 ->reverse_(ListPtr{new List_{value, this->drop(position - 1)},
                                    List_::destroy});
         }
-        /** \brief Helper function for fill().
+        /**
+         * Minimal number of nodes that is worth a separate thread
+         * in build().
+         */
+        static const size_t SEGMENT = 1 << 16;
+        /**
+         * \brief Deleter of a segment head in build().
+         *
+         * Head of a segment is allocated before it is constructed,
+         * so that previous segment can be linked to it.
+         * If construction of the segment fails,
+         * only the memory is freed.
+         */
+        struct HeadDeleter {
+            bool constructed;
+            void operator()(const List_* list) const {
+                if (this->constructed) {
+                    List_::destroy(list);
+                } else {
+                    ::operator delete(const_cast<List_*>(list));
+                }
+            }
+        };
+        /**
+         * \brief Build list in parallel segments.
          * \param amount Size of list to be created.
-         * \param tail Reference that holds pointer to list,
-         * that should be appended as a tail to newly created list.
-         * \param value Value that should appear in each node of new list.
+         * \param value Function that returns value of node by its index.
+         * It may be called from several threads at once.
+         * \param threads Maximal number of threads,
+         * `0` means one per hardware thread.
+         *
+         * The list is split into segments of at least SEGMENT nodes,
+         * one per thread.
+         * Each thread allocates nodes of its segment
+         * and links them from the end to the beginning,
+         * so all of them are allocated in parallel.
          *
-         * I need the `tail` to be an instance of ListPtr.
-         * Separate List(const T&, const List_*) constructor
-         * was created for this purpose.
+         * Last node of a segment is linked
+         * to the head of the next segment,
+         * which is allocated in advance and constructed
+         * by its own thread when the rest of the segment is ready.
+         * Sizes of nodes are passed explicitly,
+         * because the next segment may be not constructed yet.
          *
-         * The `tail` is a reference to pointer,
-         * because fill(), which called the fill_(),
-         * should have an ability to free memory
-         * in the case of fill_() fail
-         * to avoid memory leak.
-         */
-        static const List_* fill_(unsigned amount, const List_*& tail,
-                                  const T& value) {
-            if (!amount) {
-                const List_* result = tail;
-                tail = nullptr;
-                return result;
+         * If any segment fails, built segments are destroyed
+         * and the first exception is rethrown.
+         */
+        template<typename Generator>
+        static ListPtr build(const size_t amount, const Generator& value,
+                             const size_t threads = 0) {
+            if (amount == 0) {
+                throw invalid_argument("You can't create an empty list");
             }
-            tail = new List_{value, tail};
-            return fill_(amount - 1, tail, value);
+
+            const size_t segments = std::max<size_t>(1, std::min<size_t>(
+                threads ? threads : std::thread::hardware_concurrency(),
+                amount / SEGMENT));
+            std::vector<shared_ptr<const List_>> heads(1);
+            heads.reserve(segments);
+            for (size_t s = 1; s < segments; ++s) {
+                heads.emplace_back(
+                    static_cast<const List_*>(::operator new(sizeof(List_))),
+                    HeadDeleter{false});
+            }
+
+            shared_ptr<const List_> result;
+            std::vector<char> constructed(segments, false);
+            std::vector<std::exception_ptr> errors(segments);
+            auto segment = [&](const size_t s) {
+                try {
+                    const size_t first = amount * s / segments;
+                    const size_t last = amount * (s + 1) / segments;
+                    shared_ptr<const List_> tail =
+                        s + 1 < segments ? heads[s + 1] : nullptr;
+                    for (size_t i = last; i-- > first + (s > 0);) {
+                        tail = ListPtr{
+                            new List_(value(i), std::move(tail), amount - i),
+                            List_::destroy};
+                    }
+                    if (s == 0) {
+                        result = std::move(tail);
+                    } else {
+                        new (const_cast<List_*>(heads[s].get())) List_(
+                            value(first), std::move(tail), amount - first);
+                        constructed[s] = true;
+                    }
+                } catch (...) {
+                    errors[s] = std::current_exception();
+                }
+            };
+
+            std::vector<std::thread> workers;
+            try {
+                for (size_t s = 1; s < segments; ++s) {
+                    workers.emplace_back(segment, s);
+                }
+                segment(0);
+            } catch (...) {
+                errors[0] = std::current_exception();
+            }
+            for (std::thread& thread : workers) {
+                thread.join();
+            }
+
+            for (size_t s = 1; s < segments; ++s) {
+                std::get_deleter<HeadDeleter>(heads[s])->constructed =
+                    constructed[s];
+            }
+            for (const std::exception_ptr& error : errors) {
+                if (error) {
+                    result.reset();
+                    for (shared_ptr<const List_>& head : heads) {
+                        head.reset();
+                    }
+                    std::rethrow_exception(error);
+                }
+            }
+            return result;
         }
-        /** \brief Helper constructor for initializer list arguments.
-         * \param begin Beginning of values array.
-         * \param size Size of the `begin` array.
+        /**
+         * \brief Helper for fromRange() with random access iterators.
+         *
+         * Values are read by index, so the range is built by build().
+         */
+        template<typename Iterator>
+        static ListPtr fromRange(const Iterator first, const Iterator last,
+                                 std::random_access_iterator_tag) {
+            return build(std::distance(first, last),
+                         [first](const size_t index) -> decltype(auto) {
+                             return first[index];
+                         });
+        }
+        /**
+         * \brief Helper for fromRange() with bidirectional iterators.
          *
-         * Used in List(const initializer_list<T>) constructor.
-         * First element of `begin` array
-         * becomes a value of head of the list.
-         * If there are more than one element in the array,
-         * tail will be created recursively
-         * from pointer to the second element.
+         * Nodes are created from the end of the range,
+         * so each node is linked to already created tail
+         * and no reversal is needed.
+         * Not yet wrapped nodes are kept in TailGuard.
+         */
+        template<typename Iterator>
+        static ListPtr fromRange(const Iterator first, Iterator last,
+                                 std::bidirectional_iterator_tag) {
+            if (first == last) {
+                throw invalid_argument("You can't create an empty list");
+            }
+
+            TailGuard guard{};
+            while (last != first) {
+                guard.ptr = new List_{*--last, guard.ptr};
+            }
+            const List_* result = guard.ptr;
+            guard.ptr = nullptr;
+            return ListPtr{result, List_::destroy};
+        }
+        /**
+         * \brief Helper for fromRange() with input and forward iterators.
          *
-         * Should not be used with empty arrays.
-         * Size should be specified correctly.
+         * Such range can be passed only forward,
+         * so values are copied into a buffer with random access first.
          */
-        List_(const T* begin, const size_t size)
-                : value{*begin}
-                , tail_{size > 1? ListPtr{new List_(begin + 1, size - 1),
-                                          List_::destroy}
-                               : nullptr}
-                , size_{size} {
+        template<typename Iterator>
+        static ListPtr fromRange(const Iterator first, const Iterator last,
+                                 std::input_iterator_tag) {
+            const std::vector<typename std::remove_cv<T>::type> buffer(
+                first, last);
+            return fromRange(buffer.cbegin(), buffer.cend());
         }
+        /**
+         * \brief Owner of a chain of nodes under construction.
+         *
+         * Nodes that are not yet wrapped into `shared_ptr`
+         * are destroyed if construction fails.
+         * Successfully created chain should be taken from the guard
+         * by setting `ptr` to `nullptr`.
+         */
+        struct TailGuard {
+            const List_* ptr;
+            ~TailGuard() {
+                List_::destroy(this->ptr);
+            }
+        };
         /**
          * \brief Take a regular pointer and wrap it into `shared_ptr`.
          * \param value Value of the head.
@@ -149,6 +287,21 @@ private:
             , tail_{tail_, List_::destroy}
             , size_{tail_ ? tail_->size_ + 1 : 1} {
         }
+        /**
+         * \param value Value of the head.
+         * \param tail Tail of the list.
+         * \param size Size of the list.
+         *
+         * Used by build(), where `tail` may be a head of segment
+         * that is not constructed yet,
+         * so its size cannot be read.
+         */
+        List_(const T& value, shared_ptr<const List_>&& tail,
+              const size_t size)
+            : value{value}
+            , tail_{std::move(tail)}
+            , size_{size} {
+        }
         /**
          * Custom destruction function List_::destroy()
          * should be used instead of destructor for long lists
@@ -166,19 +319,13 @@ private:
                 , tail_{tail_}
                 , size_{tail_? tail_->size_ + 1 : 1} {
         }
-        /** \brief Creates new instance of List from initializer list.
-         * \param value Initializer list of values for the list.
-         */
-        explicit List_(const initializer_list<T> value)
-                : value{*value.begin()}
-                , tail_{value.size() > 1
-                    ? ListPtr{new List_{value.begin() + 1, value.size() - 1},
-                              List_::destroy}
-                    : nullptr}
-                , size_{value.size()} {
-            if (value.size() == 0) {
-                throw invalid_argument("You can't create an empty list");
-            }
+        /**
+         * \param value Value of the only element of the list.
+         */
+        explicit List_(const T& value)
+                : value{value}
+                , tail_{nullptr}
+                , size_{1} {
         }
         /**
          * Copy constructor is not needed,
@@ -198,6 +345,72 @@ private:
          * so the copy constructor was explicitly introduced.
          */
         List_(List_&&) = default;
+        /**
+         * \brief Forward iterator over values of the list.
+         *
+         * Iterator walks raw node pointers
+         * instead of copying `shared_ptr` tails,
+         * so traversal does not touch reference counters.
+         * The list should outlive its iterators.
+         */
+        class Iterator {
+        private:
+            /**
+             * Node that the iterator points to.
+             * `nullptr` means end of the list.
+             */
+            const List_* node;
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = typename std::remove_cv<T>::type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T*;
+            using reference = const T&;
+            /**
+             * \param node Node to start from, end of the list by default.
+             */
+            explicit Iterator(const List_* node = nullptr) : node{node} {
+            }
+            reference operator*() const {
+                return this->node->value;
+            }
+            pointer operator->() const {
+                return &this->node->value;
+            }
+            Iterator& operator++() {
+                this->node = this->node->tail_.get();
+                return *this;
+            }
+            Iterator operator++(int) {
+                Iterator previous{*this};
+                ++*this;
+                return previous;
+            }
+            bool operator==(const Iterator& iterator) const {
+                return this->node == iterator.node;
+            }
+            bool operator!=(const Iterator& iterator) const {
+                return this->node != iterator.node;
+            }
+        };
+        /**
+         * \return Iterator to the head of the list.
+         */
+        Iterator begin() const {
+            return Iterator{this};
+        }
+        /**
+         * \return Iterator past the last element of the list.
+         */
+        Iterator end() const {
+            return Iterator{};
+        }
+        /**
+         * Get value of the head in OOP way.
+         */
+        const T& head() const {
+            return this->value;
+        }
         /**
          * Get size of the list in OOP way.
          */
@@ -205,21 +418,44 @@ private:
             return this->size_;
         }
         /**
+         * \param list List to compare with.
+         * \return Number of last nodes that are shared with `list`.
+         *
+         * Lists that share a node share all the following nodes too,
+         * so only nodes at the same distance from the end
+         * need to be compared.
+         */
+        size_t shared(const List_& list) const {
+            const List_* a = this;
+            const List_* b = &list;
+            for (; a->size_ > b->size_; a = a->tail_.get());
+            for (; b->size_ > a->size_; b = b->tail_.get());
+            for (; a != b; a = a->tail_.get(), b = b->tail_.get());
+            return a ? a->size_ : 0;
+        }
+        /**
+         * \param list List to insert into.
          * \param value Value to be inserted.
          * \param position Index of the inserted element in resulting list.
-         * \return List with new element.
+         * \return List with new element inserted.
          *
-         * When `position` equals `0`, the element is a new head.
+         * When `position` equals `0`, the element is a new head
+         * linked to `list` itself.
+         * Node does not own pointer to itself,
+         * so the method takes the pointer and is static.
          * When `position` is equal to size, append() will be called.
-         * \return List with new element inserted.
          */
-        ListPtr insert(const T& value, const size_t position = 0) const {
-            if (position > this->size_) {
+        static ListPtr insert(ListPtr& list, const T& value,
+                              const size_t position = 0) {
+            if (position > list->size_) {
                 throw invalid_argument(
                     "Position should not be greater than list size"
                 );
             }
-            return this->insert_(value, position);
+            if (position == 0) {
+                return ListPtr{new List_{value, list}, List_::destroy};
+            }
+            return list->insert_(value, position);
         }
         /**
          * \param position Position of element to be removed.
@@ -310,19 +546,99 @@ private:
         ListPtr concat(ListPtr list) const {
             return this->reverse()->reverse_(list);
         }
+        /**
+         * \param value Value to search for.
+         * \return Iterator to the first node with `value`
+         * or end() if there is no such node.
+         */
+        Iterator find(const T& value) const {
+            const List_* node = this;
+            for (; node && node->value != value; node = node->tail_.get());
+            return Iterator{node};
+        }
+        /**
+         * \param value Value to search for.
+         * \return `true` if any node of the list holds `value`.
+         */
+        bool contains(const T& value) const {
+            return this->find(value) != this->end();
+        }
+        /**
+         * \param value Value to search for.
+         * \return Number of nodes that hold `value`.
+         */
+        size_t count(const T& value) const {
+            size_t result = 0;
+            for (const List_* node = this; node; node = node->tail_.get()) {
+                result += node->value == value;
+            }
+            return result;
+        }
+        /**
+         * \param value Value to search for.
+         * \return Index of the first node with `value`
+         * or size of the list if there is no such node.
+         */
+        size_t indexOf(const T& value) const {
+            size_t index = 0;
+            for (const List_* node = this;
+                 node && node->value != value;
+                 node = node->tail_.get(), ++index);
+            return index;
+        }
+        /**
+         * \return The least value of the list.
+         * The first one is returned when there are several of them.
+         */
+        const T& min() const {
+            const T* result = &this->value;
+            for (const List_* node = this->tail_.get(); node;
+                 node = node->tail_.get()) {
+                if (node->value < *result) {
+                    result = &node->value;
+                }
+            }
+            return *result;
+        }
+        /**
+         * \return The greatest value of the list.
+         * The first one is returned when there are several of them.
+         */
+        const T& max() const {
+            const T* result = &this->value;
+            for (const List_* node = this->tail_.get(); node;
+                 node = node->tail_.get()) {
+                if (*result < node->value) {
+                    result = &node->value;
+                }
+            }
+            return *result;
+        }
         /**
          * \brief Check whether lists are not equal.
          * Equality means same number of nodes with same values.
          * \param list List to compare with.
          * \return `false` if lists are equal,
          * `true` otherwise.
+         *
+         * Lists of different size are rejected without traversal.
+         * Otherwise nodes are compared in a loop
+         * until the lists reach a shared tail,
+         * which is equal to itself by definition.
+         * The loop replaces recursion,
+         * so long lists cannot overflow the stack.
          */
         bool operator!=(const List_& list) const {
-            return false
-                || ((!this->tail_) ^ (!list.tail_))
-                || (this->value != list.value)
-                || (this->tail_ != list.tail_
-                    && *(this->tail_) != *(list.tail_));
+            if (this->size_ != list.size_) {
+                return true;
+            }
+            for (const List_* a = this, * b = &list; a != b;
+                 a = a->tail_.get(), b = b->tail_.get()) {
+                if (a->value != b->value) {
+                    return true;
+                }
+            }
+            return false;
         }
         /**
          * \brief Check whether lists are equal.
@@ -337,33 +653,42 @@ private:
         /**
          * \param amount Size of list to be created.
          * \param value Value that should appear in each node of new list.
+         * \param threads Maximal number of threads, `0` means default.
          *
-         * Public iterface for private List_::fill_() method.
-         * It wraps List_::fill_() result into `shared_ptr`
-         * with custom destruction function destroy().
+         * Public interface for private List_::build() method.
+         */
+        static ListPtr fill(size_t amount, const T& value,
+                            const size_t threads = 0) {
+            return build(amount, [&value](size_t) -> const T& {
+                return value;
+            }, threads);
+        }
+        /**
+         * \param amount Size of list to be created.
+         * \param value Function that returns value of node by its index.
+         * It may be called from several threads at once.
+         * \param threads Maximal number of threads, `0` means default.
          *
-         * Also it creates a guard for tail,
-         * that will destroy the tail if something will go wrong.
-         * List::fill_() should store `tail`,
-         * that is not yet wrapped into `shared_ptr`,
-         * in the guard, and set it to `nullptr` in the end
-         * in order to avoid destruction of successfully created list.
-         */
-        static ListPtr fill(size_t amount, const T& value) {
-            if (amount == 0) {
-                throw invalid_argument("You can't create an empty list");
-            }
-
-            struct TailGuard {
-                const List_* ptr;
-                ~TailGuard() {
-                    List_::destroy(this->ptr);
-                }
-            } guard{};
-            const List_* result = fill_(amount, guard.ptr, value);
-            return amount
-                ? ListPtr{result, List_::destroy}
-                : nullptr;
+         * Public interface for private List_::build() method.
+         */
+        template<typename Generator>
+        static ListPtr generate(size_t amount, const Generator& value,
+                                const size_t threads = 0) {
+            return build(amount, value, threads);
+        }
+        /**
+         * \param first Beginning of the range.
+         * \param last End of the range.
+         * \return List with values of the range.
+         *
+         * Ranges with random access are built in parallel by build(),
+         * bidirectional ranges are built sequentially,
+         * and other ranges are buffered before build().
+         */
+        template<typename Iterator>
+        static ListPtr fromRange(const Iterator first, const Iterator last) {
+            return fromRange(first, last,
+                typename std::iterator_traits<Iterator>::iterator_category{});
         }
         /** \brief Custom destruction strategy,
          * which should be called in order to delete a list.
@@ -401,6 +726,57 @@ private:
     explicit List(const shared_ptr<const List_>& list) : list{list} {
     };
 public:
+    /**
+     * \brief Statically allocated nodes that are never destroyed.
+     *
+     * Nodes are constructed in the storage of Immortal itself
+     * and are linked with `shared_ptr`s that own nothing,
+     * so construction does not allocate memory
+     * and reference counting never calls List_::destroy() for them.
+     * Runtime lists may use list() as a shared tail.
+     *
+     * Nodes are not destroyed together with Immortal,
+     * so it should have static storage duration
+     * and outlive all lists that share it.
+     */
+    template<size_t N> class Immortal {
+    private:
+        static_assert(N > 0, "You can't create an empty list");
+        /**
+         * Storage for nodes of the list.
+         */
+        typename std::aligned_storage<sizeof(List_), alignof(List_)>::type
+            nodes[N];
+        /**
+         * Non-owning pointer to the first node.
+         */
+        shared_ptr<const List_> head;
+    public:
+        /**
+         * \param values Array of values of the list.
+         *
+         * Size of the array is a part of the parameter type,
+         * so an array of other size is rejected by compiler.
+         */
+        explicit Immortal(const T (&values)[N]) {
+            for (size_t i = N; i-- > 0;) {
+                const List_* node =
+                    new (&this->nodes[i]) List_(values[i], this->head);
+                this->head = shared_ptr<const List_>{
+                    shared_ptr<const List_>{}, node};
+            }
+        }
+        /**
+         * Nodes are shared by address, so they cannot be copied.
+         */
+        Immortal(const Immortal&) = delete;
+        /**
+         * \return List that consists of immortal nodes.
+         */
+        const List list() const {
+            return List{this->head};
+        }
+    };
     /** \brief Create a list with a single element.
      * \param value Value of the head.
      */
@@ -419,7 +795,22 @@ public:
      * \param value Initializer list of values for the list.
      */
     explicit List(const initializer_list<T> value)
-        : list{new List_{value}, List_::destroy} {
+        : list{List_::fromRange(value.begin(), value.end())} {
+    }
+    /** \brief Create new instance of List from range of values.
+     * \param first Beginning of the range.
+     * \param last End of the range.
+     *
+     * Any input iterators are accepted.
+     * Large ranges with random access are built in parallel,
+     * see List_::build for details.
+     * Ranges that can't be passed backwards
+     * are copied into a temporary buffer first.
+     */
+    template<typename Iterator, typename =
+             typename std::iterator_traits<Iterator>::iterator_category>
+    List(const Iterator first, const Iterator last)
+        : list{List_::fromRange(first, last)} {
     }
     /**
      * List instances can be copied,
@@ -436,6 +827,28 @@ public:
      * \brief Destructor is default.
      */
     ~List() = default;
+    /**
+     * @copydoc List_::Iterator
+     */
+    using Iterator = typename List_::Iterator;
+    /**
+     * @copydoc List_::begin
+     */
+    Iterator begin() const {
+        return this->list->begin();
+    }
+    /**
+     * @copydoc List_::end
+     */
+    Iterator end() const {
+        return this->list->end();
+    }
+    /**
+     * @copydoc List_::head
+     */
+    const T& head() const {
+        return this->list->head();
+    }
     /**
      * @copydoc List_::size
      */
@@ -443,10 +856,22 @@ public:
         return this->list->size();
     }
     /**
-     * @copydoc List_::insert
+     * @copydoc List_::shared
+     */
+    size_t shared(const List& list) const {
+        return this->list->shared(*list.list);
+    }
+    /**
+     * \param value Value to be inserted.
+     * \param position Index of the inserted element in resulting list.
+     * \return List with new element inserted.
+     *
+     * When `position` equals `0`, the element is a new head
+     * linked to this list.
+     * When `position` is equal to size, the element is appended.
      */
     const List insert(const T& value, const size_t position = 0) const {
-        return List{this->list->insert(value, position)};
+        return List{List_::insert(this->list, value, position)};
     }
     /**
      * @copydoc List_::remove
@@ -490,6 +915,42 @@ public:
     const List concat(const List& list) const {
         return List{this->list->concat(list.list)};
     }
+    /**
+     * @copydoc List_::find
+     */
+    Iterator find(const T& value) const {
+        return this->list->find(value);
+    }
+    /**
+     * @copydoc List_::contains
+     */
+    bool contains(const T& value) const {
+        return this->list->contains(value);
+    }
+    /**
+     * @copydoc List_::count
+     */
+    size_t count(const T& value) const {
+        return this->list->count(value);
+    }
+    /**
+     * @copydoc List_::indexOf
+     */
+    size_t indexOf(const T& value) const {
+        return this->list->indexOf(value);
+    }
+    /**
+     * @copydoc List_::min
+     */
+    const T& min() const {
+        return this->list->min();
+    }
+    /**
+     * @copydoc List_::max
+     */
+    const T& max() const {
+        return this->list->max();
+    }
     /**
      * @copydoc List_::operator!=
      */
@@ -506,11 +967,43 @@ public:
      * \brief Create new List of specific length with specific values.
      * \param amount Size of list to be created.
      * \param value Value that should appear in each node of new list.
+     * \param threads Maximal number of threads,
+     * `0` means one per hardware thread.
+     *
+     * Large lists are built in parallel,
+     * see List_::build for implementation details.
+     */
+    static const List fill(size_t amount, const T& value,
+                           const size_t threads = 0) {
+        return List{List_::fill(amount, value, threads)};
+    }
+    /**
+     * \brief Create new List of specific length
+     * with values produced by a function.
+     * \param amount Size of list to be created.
+     * \param value Function that takes index of a node
+     * and returns its value.
+     * \param threads Maximal number of threads,
+     * `0` means one per hardware thread.
+     *
+     * Large lists are built in parallel,
+     * so `value` may be called from several threads at once
+     * and in any order.
+     * See List_::build for implementation details.
+     */
+    template<typename Generator>
+    static const List generate(size_t amount, const Generator& value,
+                               const size_t threads = 0) {
+        return List{List_::generate(amount, value, threads)};
+    }
+    /**
+     * \brief Approximate memory used by one node of a list.
      *
-     * See List_::fill for implementation details.
+     * Includes the node itself
+     * and the control block of its `shared_ptr`.
      */
-    static const List fill(size_t amount, const T& value) {
-        return List{List_::fill(amount, value)};
+    static constexpr size_t nodeSize() {
+        return sizeof(List_) + 4 * sizeof(void*);
     }
 };
 
@@ -0,0 +1 @@
+#include "listhistory.hpp"
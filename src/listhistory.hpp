@@ -0,0 +1,295 @@
+#ifndef LISTHISTORY_HPP
+#define LISTHISTORY_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <stdexcept>
+
+#include "list.hpp"
+
+using std::deque;
+using std::invalid_argument;
+
+/**
+ * \brief Undo and redo history of List versions
+ * with bounded memory.
+ *
+ * Each recorded version gets a number,
+ * which can be used to check the version out in constant time.
+ * Recording a new version after a checkout
+ * discards versions that were newer than the checked out one.
+ *
+ * Memory of a version is the number of its nodes
+ * that are not shared with the previous version,
+ * multiplied by List::nodeSize().
+ * The oldest version is accounted with all its nodes.
+ *
+ * When the sum for retained versions exceeds the budget,
+ * the oldest versions are evicted,
+ * but the checked out version is always kept.
+ * Evicted nodes are not destroyed at once:
+ * each operation frees at least as many of them
+ * as it has created, so long evicted chains are
+ * reclaimed gradually instead of in one List_::destroy() call.
+ * Evicted nodes that are not yet freed are accounted as well,
+ * and while retained and evicted nodes together exceed the budget,
+ * each operation frees at least the excess.
+ * So memory() is an upper bound of memory used by the history,
+ * and it stays within the budget
+ * unless the checked out version alone exceeds it.
+ */
+template<typename T> class ListHistory {
+private:
+    /**
+     * \brief Retained version of the list.
+     */
+    struct Version {
+        /**
+         * The list itself.
+         */
+        const List<T> list;
+        /**
+         * Number of nodes that are not shared with the previous version.
+         */
+        size_t nodes;
+    };
+    /**
+     * \brief Evicted list that is being reclaimed.
+     */
+    struct Garbage {
+        /**
+         * Remaining part of the list.
+         */
+        const List<T> list;
+        /**
+         * Number of first nodes of `list`
+         * that are not shared with retained versions.
+         */
+        size_t nodes;
+    };
+    /**
+     * Memory budget in bytes.
+     */
+    const size_t budget;
+    /**
+     * Number of the oldest retained version.
+     */
+    size_t first_;
+    /**
+     * Number of the checked out version.
+     */
+    size_t current_;
+    /**
+     * Total number of nodes accounted for retained versions.
+     */
+    size_t nodes_;
+    /**
+     * Number of evicted nodes that are not yet reclaimed.
+     */
+    size_t pending_;
+    /**
+     * Retained versions, from the oldest to the newest.
+     */
+    deque<Version> versions;
+    /**
+     * Evicted lists that are not yet reclaimed.
+     */
+    deque<Garbage> garbage;
+    /**
+     * \brief Free evicted nodes.
+     * \param amount Maximal number of nodes to free.
+     *
+     * Nodes are freed one by one by replacing
+     * an evicted list with its tail.
+     * When all unshared nodes of the list are freed,
+     * the rest of it belongs to retained versions
+     * and the list is simply forgotten.
+     */
+    void reclaim(size_t amount) {
+        while (amount && !this->garbage.empty()) {
+            const Garbage& front = this->garbage.front();
+            const size_t nodes = front.nodes;
+            if (nodes > 1) {
+                Garbage next{front.list.tail(), nodes - 1};
+                this->garbage.pop_front();
+                this->garbage.push_front(next);
+            } else {
+                this->garbage.pop_front();
+            }
+            amount -= nodes > 0;
+            this->pending_ -= nodes > 0;
+        }
+    }
+    /**
+     * \return Number of nodes that exceed the budget,
+     * including evicted nodes that are not yet reclaimed.
+     */
+    size_t excess() const {
+        const size_t nodes = this->nodes_ + this->pending_;
+        const size_t limit = this->budget / List<T>::nodeSize();
+        return nodes > limit ? nodes - limit : 0;
+    }
+    /**
+     * \brief Evict the oldest versions until retained versions
+     * meet the budget or the checked out version is the oldest one.
+     *
+     * The next version becomes the oldest one,
+     * so it is accounted with all its nodes.
+     */
+    void evict() {
+        while (this->nodes_ * List<T>::nodeSize() > this->budget
+               && this->first_ < this->current_) {
+            const List<T>& oldest = this->versions[0].list;
+            Version& next = this->versions[1];
+            const size_t nodes = oldest.size() - oldest.shared(next.list);
+
+            this->nodes_ = this->nodes_ - nodes;
+            next.nodes = next.list.size();
+            this->pending_ += nodes;
+            this->garbage.push_back(Garbage{oldest, nodes});
+            this->versions.pop_front();
+            ++this->first_;
+        }
+    }
+public:
+    /**
+     * \param initial The first version of the list.
+     * \param budget Memory in bytes that the history may occupy.
+     */
+    ListHistory(const List<T>& initial, const size_t budget)
+        : budget{budget}
+        , first_{0}
+        , current_{0}
+        , nodes_{initial.size()}
+        , pending_{0}
+        , versions{Version{initial, initial.size()}} {
+    }
+    /**
+     * Copies would share evicted nodes,
+     * so neither of them could free those nodes
+     * and pending() of both would be wrong.
+     * Versions are plain lists, so copy them instead.
+     */
+    ListHistory(const ListHistory&) = delete;
+    /**
+     * \return Number of the oldest retained version.
+     */
+    size_t first() const {
+        return this->first_;
+    }
+    /**
+     * \return Number of the newest retained version.
+     */
+    size_t last() const {
+        return this->first_ + this->versions.size() - 1;
+    }
+    /**
+     * \return Number of the checked out version.
+     */
+    size_t version() const {
+        return this->current_;
+    }
+    /**
+     * \return The checked out version.
+     */
+    const List<T> current() const {
+        return this->versions[this->current_ - this->first_].list;
+    }
+    /**
+     * \param version Number of a retained version.
+     * \return The version, which becomes checked out.
+     */
+    const List<T> checkout(const size_t version) {
+        if (version < this->first_ || version > this->last()) {
+            throw invalid_argument("Version should be retained by history");
+        }
+        this->current_ = version;
+        return this->current();
+    }
+    /**
+     * \brief Record new version after the checked out one.
+     * \param list New version.
+     * \return `list`, which becomes checked out.
+     *
+     * Versions that were newer than the checked out one are discarded.
+     */
+    const List<T> record(const List<T>& list) {
+        while (this->last() > this->current_) {
+            const Version& newest = this->versions.back();
+            this->nodes_ -= newest.nodes;
+            this->pending_ += newest.nodes;
+            this->garbage.push_back(Garbage{newest.list, newest.nodes});
+            this->versions.pop_back();
+        }
+
+        const size_t nodes = list.size() - list.shared(this->current());
+        this->versions.push_back(Version{list, nodes});
+        this->nodes_ += nodes;
+        this->current_ = this->last();
+        this->evict();
+        this->reclaim(std::max(nodes + 1, this->excess()));
+        return list;
+    }
+    /**
+     * \brief Record List::insert() applied to the checked out version.
+     * @copydetails List::insert
+     */
+    const List<T> insert(const T& value, const size_t position = 0) {
+        return this->record(this->current().insert(value, position));
+    }
+    /**
+     * \brief Record List::remove() applied to the checked out version.
+     * @copydetails List::remove
+     *
+     * Lists are never empty,
+     * so the only element of a version can't be removed.
+     */
+    const List<T> remove(const size_t position = 0) {
+        if (this->current().size() == 1) {
+            throw invalid_argument("You can't create an empty list");
+        }
+        return this->record(this->current().remove(position));
+    }
+    /**
+     * \brief Record List::concat() applied to the checked out version.
+     * @copydetails List::concat
+     */
+    const List<T> concat(const List<T>& list) {
+        return this->record(this->current().concat(list));
+    }
+    /**
+     * \return Memory in bytes accounted for all retained versions
+     * and evicted nodes that are not yet reclaimed.
+     */
+    size_t memory() const {
+        return (this->nodes_ + this->pending_) * List<T>::nodeSize();
+    }
+    /**
+     * \param version Number of a retained version.
+     * \return Memory in bytes that the version adds
+     * to the previous retained version.
+     */
+    size_t memory(const size_t version) const {
+        if (version < this->first_ || version > this->last()) {
+            throw invalid_argument("Version should be retained by history");
+        }
+        return this->versions[version - this->first_].nodes
+            * List<T>::nodeSize();
+    }
+    /**
+     * \return Number of evicted nodes that are not yet reclaimed.
+     */
+    size_t pending() const {
+        return this->pending_;
+    }
+    /**
+     * \brief Free all evicted nodes at once.
+     */
+    void collect() {
+        this->garbage.clear();
+        this->pending_ = 0;
+    }
+};
+
+#endif
@@ -0,0 +1 @@
+#include "persistentvector.hpp"
@@ -0,0 +1,530 @@
+#ifndef PERSISTENTVECTOR_HPP
+#define PERSISTENTVECTOR_HPP
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+#include "list.hpp"
+
+using std::invalid_argument;
+using std::shared_ptr;
+
+/**
+ * \brief Immutable vector with effectively constant time
+ * append and indexed access.
+ *
+ * Values are stored in leaves of a 32-way trie.
+ * Index of a value is split into 5-bit parts,
+ * which select a child on each level of the trie,
+ * so the trie of depth `d` holds up to `32^(d+1)` values.
+ *
+ * The last 1 to 32 values are kept in a separate tail leaf.
+ * pushBack() and popBack() copy only this leaf
+ * and touch the trie once per 32 operations,
+ * when the tail becomes full or empty.
+ *
+ * All modifications return new vectors
+ * that share unchanged nodes with the original one.
+ *
+ * Leaves hold values in fixed arrays,
+ * so values should be default constructible.
+ */
+template<typename T> class PersistentVector {
+private:
+    /**
+     * Type of values stored in leaves.
+     */
+    using Value = typename std::remove_cv<T>::type;
+    /**
+     * Number of bits of index consumed by one level of the trie.
+     */
+    static const size_t BITS = 5;
+    /**
+     * Maximal number of children of a node.
+     */
+    static const size_t WIDTH = 1 << BITS;
+    /**
+     * Mask that extracts index of a child on one level.
+     */
+    static const size_t MASK = WIDTH - 1;
+    /**
+     * \brief Node of the trie.
+     *
+     * Node is either a Branch or a Leaf,
+     * which one is known from the level of the node.
+     */
+    struct Node {
+    };
+    /**
+     * Handy alias for Node pointer wrapped into shared pointer.
+     */
+    using NodePtr = shared_ptr<const Node>;
+    /**
+     * \brief Node with children.
+     */
+    struct Branch : Node {
+        /**
+         * Number of children in use.
+         */
+        size_t count = 0;
+        /**
+         * Children of the branch, first `count` of them are set.
+         */
+        std::array<NodePtr, WIDTH> children;
+    };
+    /**
+     * \brief Node with values.
+     *
+     * Values are stored in the node itself,
+     * so a copy of a leaf costs a single allocation.
+     */
+    struct Leaf : Node {
+        /**
+         * Number of values in use.
+         */
+        size_t count = 0;
+        /**
+         * Values of the leaf, first `count` of them are set.
+         */
+        std::array<Value, WIDTH> values;
+    };
+    /**
+     * Number of values in the vector.
+     */
+    const size_t size_;
+    /**
+     * Number of index bits consumed by levels above leaves.
+     */
+    const size_t shift;
+    /**
+     * Root branch of the trie.
+     */
+    const NodePtr root;
+    /**
+     * Leaf with the last values of the vector.
+     */
+    const NodePtr tail;
+    /**
+     * \param size Number of values.
+     * \param shift Index bits consumed above leaves.
+     * \param root Root branch of the trie.
+     * \param tail Leaf with the last values.
+     */
+    PersistentVector(const size_t size, const size_t shift,
+                     const NodePtr& root, const NodePtr& tail)
+        : size_{size}
+        , shift{shift}
+        , root{root}
+        , tail{tail} {
+    }
+    /**
+     * \param node Node that is known to be a branch.
+     */
+    static const Branch& asBranch(const NodePtr& node) {
+        return static_cast<const Branch&>(*node);
+    }
+    /**
+     * \param node Node that is known to be a leaf.
+     */
+    static const Leaf& asLeaf(const NodePtr& node) {
+        return static_cast<const Leaf&>(*node);
+    }
+    /**
+     * \param size Number of values in the vector.
+     * \return Number of values stored in the trie, not in the tail.
+     */
+    static size_t tailOffset(const size_t size) {
+        return size < WIDTH ? 0 : ((size - 1) >> BITS) << BITS;
+    }
+    /**
+     * \param level Index bits consumed above `leaf`.
+     * \param leaf Leaf to be wrapped.
+     * \return Chain of single child branches that ends with `leaf`.
+     */
+    static NodePtr newPath(const size_t level, const NodePtr& leaf) {
+        if (!level) {
+            return leaf;
+        }
+        const shared_ptr<Branch> result = std::make_shared<Branch>();
+        result->children[0] = newPath(level - BITS, leaf);
+        result->count = 1;
+        return result;
+    }
+    /**
+     * \param size Number of values in the vector
+     * including values of `leaf`.
+     * \param level Index bits consumed above `parent` children.
+     * \param parent Branch that should hold `leaf`.
+     * \param leaf Full leaf to be added to the trie.
+     * \return Copy of `parent` with `leaf` added.
+     */
+    static NodePtr pushLeaf(const size_t size, const size_t level,
+                            const Branch& parent, const NodePtr& leaf) {
+        const size_t index = ((size - 1) >> level) & MASK;
+        const shared_ptr<Branch> result = std::make_shared<Branch>(parent);
+        if (level == BITS) {
+            result->children[index] = leaf;
+        } else if (index < parent.count) {
+            result->children[index] = pushLeaf(
+                size, level - BITS, asBranch(parent.children[index]), leaf);
+        } else {
+            result->children[index] = newPath(level - BITS, leaf);
+        }
+        result->count = index + 1;
+        return result;
+    }
+    /**
+     * \param size Number of values in the vector before the removal.
+     * \param level Index bits consumed above `node` children.
+     * \param node Branch that holds the last leaf.
+     * \return Copy of `node` without the last leaf
+     * or `nullptr` if the copy would be empty.
+     */
+    static NodePtr popLeaf(const size_t size, const size_t level,
+                           const Branch& node) {
+        const size_t index = ((size - 2) >> level) & MASK;
+        NodePtr child;
+        if (level > BITS) {
+            child = popLeaf(size, level - BITS,
+                            asBranch(node.children[index]));
+        }
+        if (!child && index == 0) {
+            return nullptr;
+        }
+        const shared_ptr<Branch> result = std::make_shared<Branch>(node);
+        result->children[index] = child;
+        result->count = child ? index + 1 : index;
+        return result;
+    }
+    /**
+     * \param level Index bits consumed above `node` children.
+     * \param node Node that holds value with `index`.
+     * \param index Index of the value to be replaced.
+     * \param value New value.
+     * \return Copy of `node` with the value replaced.
+     */
+    static NodePtr set_(const size_t level, const NodePtr& node,
+                        const size_t index, const T& value) {
+        if (!level) {
+            const shared_ptr<Leaf> result =
+                std::make_shared<Leaf>(asLeaf(node));
+            result->values[index & MASK] = value;
+            return result;
+        }
+        const size_t child = (index >> level) & MASK;
+        const Branch& branch = asBranch(node);
+        const shared_ptr<Branch> result = std::make_shared<Branch>(branch);
+        result->children[child] = set_(
+            level - BITS, branch.children[child], index, value);
+        return result;
+    }
+    /**
+     * \param size Number of values in the vector
+     * including values of `leaf`.
+     * \param shift Index bits consumed above leaves,
+     * will be updated if the trie grows.
+     * \param root Root of the trie,
+     * will be replaced with a new root.
+     * \param leaf Full leaf to be added to the trie.
+     */
+    static void grow(const size_t size, size_t& shift, NodePtr& root,
+                     const NodePtr& leaf) {
+        if ((size >> BITS) > (size_t{1} << shift)) {
+            const shared_ptr<Branch> result = std::make_shared<Branch>();
+            result->children[0] = root;
+            result->children[1] = newPath(shift, leaf);
+            result->count = 2;
+            root = result;
+            shift += BITS;
+        } else {
+            root = pushLeaf(size, shift, asBranch(root), leaf);
+        }
+    }
+    /**
+     * \param index Index of a value in the vector.
+     * \return Leaf that holds value with `index`.
+     */
+    const NodePtr& leafFor(const size_t index) const {
+        if (index >= tailOffset(this->size_)) {
+            return this->tail;
+        }
+        const NodePtr* node = &this->root;
+        for (size_t level = this->shift; level; level -= BITS) {
+            node = &asBranch(*node).children[(index >> level) & MASK];
+        }
+        return *node;
+    }
+    /**
+     * \brief Build vector from a range of values.
+     * \param first Beginning of the range.
+     * \param last End of the range.
+     * \return Vector with values of the range.
+     *
+     * Leaves are filled in place
+     * and added to the trie once per 32 values,
+     * so the values are not copied from tail to tail.
+     */
+    template<typename Iterator>
+    static PersistentVector build(Iterator first, const Iterator last) {
+        size_t size = 0;
+        size_t shift = BITS;
+        NodePtr root = std::make_shared<Branch>();
+        shared_ptr<Leaf> leaf = std::make_shared<Leaf>();
+        for (; first != last; ++first, ++size) {
+            if (leaf->count == WIDTH) {
+                grow(size, shift, root, leaf);
+                leaf = std::make_shared<Leaf>();
+            }
+            leaf->values[leaf->count++] = *first;
+        }
+        return PersistentVector{size, shift, root, leaf};
+    }
+public:
+    /**
+     * \brief Bidirectional iterator over values of the vector.
+     *
+     * Iterator remembers current leaf
+     * and looks up the trie once per 32 values.
+     * The vector should outlive its iterators.
+     */
+    class Iterator {
+    private:
+        /**
+         * Vector that is iterated.
+         */
+        const PersistentVector* vector_;
+        /**
+         * Index of current value.
+         */
+        size_t index;
+        /**
+         * Leaf that holds current value.
+         */
+        const Leaf* leaf;
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = Value;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+        /**
+         * \param vector Vector to iterate.
+         * \param index Index of the value to start from.
+         */
+        Iterator(const PersistentVector* vector, const size_t index)
+            : vector_{vector}
+            , index{index}
+            , leaf{index < vector->size_
+                ? &asLeaf(vector->leafFor(index))
+                : nullptr} {
+        }
+        reference operator*() const {
+            return this->leaf->values[this->index & MASK];
+        }
+        pointer operator->() const {
+            return &**this;
+        }
+        Iterator& operator++() {
+            if ((++this->index & MASK) == 0) {
+                this->leaf = this->index < this->vector_->size_
+                    ? &asLeaf(this->vector_->leafFor(this->index))
+                    : nullptr;
+            }
+            return *this;
+        }
+        Iterator operator++(int) {
+            Iterator previous{*this};
+            ++*this;
+            return previous;
+        }
+        Iterator& operator--() {
+            if (!this->leaf || (this->index & MASK) == 0) {
+                this->leaf = &asLeaf(this->vector_->leafFor(this->index - 1));
+            }
+            --this->index;
+            return *this;
+        }
+        Iterator operator--(int) {
+            Iterator previous{*this};
+            --*this;
+            return previous;
+        }
+        bool operator==(const Iterator& iterator) const {
+            return this->index == iterator.index;
+        }
+        bool operator!=(const Iterator& iterator) const {
+            return this->index != iterator.index;
+        }
+    };
+    /**
+     * \brief Create an empty vector.
+     */
+    PersistentVector()
+        : PersistentVector{0, BITS, std::make_shared<Branch>(),
+                           std::make_shared<Leaf>()} {
+    }
+    /** \brief Create new instance of PersistentVector
+     * from initializer list.
+     * \param values Initializer list of values for the vector.
+     */
+    explicit PersistentVector(const initializer_list<T> values)
+        : PersistentVector{build(values.begin(), values.end())} {
+    }
+    /** \brief Create vector with values of a range.
+     * \param first Beginning of the range.
+     * \param last End of the range.
+     */
+    template<typename Iterator, typename =
+             typename std::iterator_traits<Iterator>::iterator_category>
+    PersistentVector(const Iterator first, const Iterator last)
+        : PersistentVector{build(first, last)} {
+    }
+    /** \brief Create vector with values of the list.
+     * \param list List to be converted.
+     */
+    explicit PersistentVector(const List<T>& list)
+        : PersistentVector{build(list.begin(), list.end())} {
+    }
+    /**
+     * PersistentVector instances can be copied,
+     * because they only share nodes.
+     */
+    PersistentVector(const PersistentVector&) = default;
+    /**
+     * Vectors returned from functions are moved.
+     */
+    PersistentVector(PersistentVector&&) = default;
+    /**
+     * Get size of the vector in OOP way.
+     */
+    size_t size() const {
+        return this->size_;
+    }
+    /**
+     * \return Iterator to the first value.
+     */
+    Iterator begin() const {
+        return Iterator{this, 0};
+    }
+    /**
+     * \return Iterator past the last value.
+     */
+    Iterator end() const {
+        return Iterator{this, this->size_};
+    }
+    /**
+     * \param index Index of the value.
+     * \return Value with `index`.
+     */
+    const T& at(const size_t index) const {
+        if (index >= this->size_) {
+            throw invalid_argument("Index should be less than vector size");
+        }
+        return asLeaf(this->leafFor(index)).values[index & MASK];
+    }
+    /**
+     * \param index Index of the value to be replaced.
+     * \param value New value.
+     * \return Vector with value at `index` replaced with `value`.
+     */
+    const PersistentVector set(const size_t index, const T& value) const {
+        if (index >= this->size_) {
+            throw invalid_argument("Index should be less than vector size");
+        }
+        if (index >= tailOffset(this->size_)) {
+            return PersistentVector{this->size_, this->shift, this->root,
+                                    set_(0, this->tail, index, value)};
+        }
+        return PersistentVector{this->size_, this->shift,
+                                set_(this->shift, this->root, index, value),
+                                this->tail};
+    }
+    /**
+     * \param value Value to append.
+     * \return Vector with `value` appended to the end.
+     */
+    const PersistentVector pushBack(const T& value) const {
+        if (this->size_ - tailOffset(this->size_) < WIDTH) {
+            const shared_ptr<Leaf> tail =
+                std::make_shared<Leaf>(asLeaf(this->tail));
+            tail->values[tail->count++] = value;
+            return PersistentVector{this->size_ + 1, this->shift,
+                                    this->root, tail};
+        }
+        size_t shift = this->shift;
+        NodePtr root = this->root;
+        grow(this->size_, shift, root, this->tail);
+        const shared_ptr<Leaf> tail = std::make_shared<Leaf>();
+        tail->values[tail->count++] = value;
+        return PersistentVector{this->size_ + 1, shift, root, tail};
+    }
+    /**
+     * \return Vector without the last value.
+     */
+    const PersistentVector popBack() const {
+        if (this->size_ == 0) {
+            throw invalid_argument("You can't remove from an empty vector");
+        } else if (this->size_ == 1) {
+            return PersistentVector{};
+        } else if (this->size_ - tailOffset(this->size_) > 1) {
+            const shared_ptr<Leaf> tail =
+                std::make_shared<Leaf>(asLeaf(this->tail));
+            tail->values[--tail->count] = Value{};
+            return PersistentVector{this->size_ - 1, this->shift,
+                                    this->root, tail};
+        }
+        NodePtr root = popLeaf(this->size_, this->shift,
+                               asBranch(this->root));
+        size_t shift = this->shift;
+        if (!root) {
+            root = std::make_shared<Branch>();
+        } else if (shift > BITS && asBranch(root).count == 1) {
+            const NodePtr child = asBranch(root).children[0];
+            root = child;
+            shift -= BITS;
+        }
+        return PersistentVector{this->size_ - 1, shift, root,
+                                this->leafFor(this->size_ - 2)};
+    }
+    /**
+     * \return List with values of the vector.
+     */
+    const List<T> toList() const {
+        return List<T>{this->begin(), this->end()};
+    }
+    /**
+     * \brief Check whether vectors are not equal.
+     * Equality means same number of values with same values.
+     * \param vector Vector to compare with.
+     * \return `false` if vectors are equal,
+     * `true` otherwise.
+     */
+    bool operator!=(const PersistentVector& vector) const {
+        if (this->size_ != vector.size_) {
+            return true;
+        }
+        for (Iterator a = this->begin(), b = vector.begin();
+             a != this->end(); ++a, ++b) {
+            if (*a != *b) {
+                return true;
+            }
+        }
+        return false;
+    }
+    /**
+     * \brief Check whether vectors are equal.
+     * Equality means same number of values with same values.
+     * \param vector Vector to compare with.
+     * \return `true` if vectors are equal,
+     * `false` otherwise.
+     */
+    bool operator==(const PersistentVector& vector) const {
+        return !(*this != vector);
+    }
+};
+
+#endif
@@ -0,0 +1 @@
+#include "staticlist.hpp"
@@ -0,0 +1,213 @@
+#ifndef STATICLIST_HPP
+#define STATICLIST_HPP
+
+#include <cstddef>
+#include <stdexcept>
+
+using std::invalid_argument;
+
+/**
+ * \brief Immutable list over a compile-time array.
+ *
+ * StaticList is a read-only view of a `constexpr` array
+ * with the read interface of List.
+ * All methods are `constexpr`,
+ * so lookup tables built from it are evaluated by compiler
+ * and need no memory allocation at all.
+ *
+ * Unlike List, the view can be empty:
+ * tail() of a single element list and drop() of all elements
+ * return a list of size `0`.
+ *
+ * Some methods differ from List:
+ * - drop(amount) removes exactly `amount` elements,
+ *   while List::drop(amount) removes `amount + 1` of them;
+ * - slice() may contain the whole list,
+ *   while List::slice() throws in this case.
+ *
+ * Use List::Immortal to share the array
+ * as a tail of runtime List values.
+ */
+template<typename T> class StaticList {
+private:
+    /**
+     * Pointer to the first value of the list.
+     */
+    const T* values;
+    /**
+     * Size of the list.
+     */
+    size_t size_;
+    /**
+     * \param values Pointer to the first value.
+     * \param size Number of values in the list.
+     */
+    constexpr StaticList(const T* values, const size_t size)
+        : values{values}
+        , size_{size} {
+    }
+public:
+    /** \brief Create a list that views array of values.
+     * \param values Array with static storage duration.
+     */
+    template<size_t N> constexpr explicit StaticList(const T (&values)[N])
+        : values{values}
+        , size_{N} {
+    }
+    /**
+     * Get size of the list in OOP way.
+     */
+    constexpr size_t size() const {
+        return this->size_;
+    }
+    /**
+     * Get value of the head in OOP way.
+     */
+    constexpr const T& head() const {
+        return this->size_
+            ? this->values[0]
+            : throw invalid_argument("Empty list has no head");
+    }
+    /**
+     * Get tail of the list in OOP way.
+     */
+    constexpr StaticList tail() const {
+        return this->drop(1);
+    }
+    /**
+     * \return Pointer to the head of the list.
+     */
+    constexpr const T* begin() const {
+        return this->values;
+    }
+    /**
+     * \return Pointer past the last element of the list.
+     */
+    constexpr const T* end() const {
+        return this->values + this->size_;
+    }
+    /**
+     * \param amount Number of elements to remove.
+     * \return List without first `amount` elements
+     * of current List.
+     *
+     * Unlike List::drop(), exactly `amount` elements are removed.
+     */
+    constexpr StaticList drop(const size_t amount) const {
+        return amount >= this->size_
+            ? StaticList{this->end(), 0}
+            : StaticList{this->values + amount, this->size_ - amount};
+    }
+    /**
+     * \param first Amount of elements to be dropped
+     * from the beginning of the list.
+     * \param last Index of the last element that should appear
+     * in new list.
+     * \return List that contains elements
+     * that had indices from `first` to `last` (including)
+     * from original list.
+     *
+     * Unlike List::slice(), the slice may contain the whole list.
+     */
+    constexpr StaticList slice(const size_t first,
+                               const size_t last = -1) const {
+        return first > last
+            ? throw invalid_argument(
+                "Slice first element index should not "
+                "be less than slice last element index")
+            : last >= this->size_
+                ? this->drop(first)
+                : StaticList{this->values + first, last - first + 1};
+    }
+    /**
+     * \param value Value to search for.
+     * \return Pointer to the first element equal to `value`
+     * or end() if there is no such element.
+     */
+    constexpr const T* find(const T& value) const {
+        const T* it = this->begin();
+        for (; it != this->end() && *it != value; ++it);
+        return it;
+    }
+    /**
+     * \param value Value to search for.
+     * \return `true` if any element of the list equals `value`.
+     */
+    constexpr bool contains(const T& value) const {
+        return this->find(value) != this->end();
+    }
+    /**
+     * \param value Value to search for.
+     * \return Number of elements equal to `value`.
+     */
+    constexpr size_t count(const T& value) const {
+        size_t result = 0;
+        for (const T* it = this->begin(); it != this->end(); ++it) {
+            result += *it == value;
+        }
+        return result;
+    }
+    /**
+     * \param value Value to search for.
+     * \return Index of the first element equal to `value`
+     * or size of the list if there is no such element.
+     */
+    constexpr size_t indexOf(const T& value) const {
+        return this->find(value) - this->begin();
+    }
+    /**
+     * \return The least value of the list.
+     */
+    constexpr const T& min() const {
+        const T* result = &this->head();
+        for (const T* it = this->begin(); it != this->end(); ++it) {
+            if (*it < *result) {
+                result = it;
+            }
+        }
+        return *result;
+    }
+    /**
+     * \return The greatest value of the list.
+     */
+    constexpr const T& max() const {
+        const T* result = &this->head();
+        for (const T* it = this->begin(); it != this->end(); ++it) {
+            if (*result < *it) {
+                result = it;
+            }
+        }
+        return *result;
+    }
+    /**
+     * \brief Check whether lists are not equal.
+     * Equality means same number of elements with same values.
+     * \param list List to compare with.
+     * \return `false` if lists are equal,
+     * `true` otherwise.
+     */
+    constexpr bool operator!=(const StaticList& list) const {
+        if (this->size_ != list.size_) {
+            return true;
+        }
+        for (size_t i = 0; this->values != list.values && i < this->size_;
+             ++i) {
+            if (this->values[i] != list.values[i]) {
+                return true;
+            }
+        }
+        return false;
+    }
+    /**
+     * \brief Check whether lists are equal.
+     * Equality means same number of elements with same values.
+     * \param list List to compare with.
+     * \return `true` if lists are equal,
+     * `false` otherwise.
+     */
+    constexpr bool operator==(const StaticList& list) const {
+        return !(*this != list);
+    }
+};
+
+#endif
@@ -1,4 +1,10 @@
+#include <algorithm>
+#include <forward_list>
+#include <iterator>
 #include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
 
 #include "testlist.hpp"
 
@@ -220,3 +226,211 @@ TYPED_TEST(ListTest, FillLargeSuccess) {
 
     ASSERT_TRUE(List_::fill(1E5, 0).size() == 1E5);
 }
+
+TYPED_TEST(ListTest, HeadReturnsFirstElement) {
+    using List_ = typename TestFixture::List_;
+
+    List_ list{3, 1, 2};
+    ASSERT_TRUE(list.head() == 3);
+    ASSERT_TRUE(list.tail().head() == 1);
+}
+
+TYPED_TEST(ListTest, IterationVisitsAllElementsInOrder) {
+    using List_ = typename TestFixture::List_;
+
+    List_ list{1, 2, 3, 4, 5};
+    TypeParam expected = 1;
+    for (const auto& value : list) {
+        ASSERT_TRUE(value == expected++);
+    }
+    ASSERT_TRUE(expected == 6);
+}
+
+TYPED_TEST(ListTest, FindReturnsFirstMatchingElement) {
+    using List_ = typename TestFixture::List_;
+
+    List_ list{1, 2, 3, 2, 1};
+    auto found = list.find(2);
+    ASSERT_TRUE(found != list.end());
+    ASSERT_TRUE(*found == 2);
+    ASSERT_TRUE(*++found == 3);
+    ASSERT_TRUE(list.find(4) == list.end());
+}
+
+TYPED_TEST(ListTest, ContainsDetectsPresentElements) {
+    using List_ = typename TestFixture::List_;
+
+    List_ list{1, 2, 3};
+    ASSERT_TRUE(list.contains(1));
+    ASSERT_TRUE(list.contains(3));
+    ASSERT_FALSE(list.contains(4));
+}
+
+TYPED_TEST(ListTest, CountCountsAllOccurrences) {
+    using List_ = typename TestFixture::List_;
+
+    List_ list{1, 2, 1, 3, 1};
+    ASSERT_TRUE(list.count(1) == 3u);
+    ASSERT_TRUE(list.count(2) == 1u);
+    ASSERT_TRUE(list.count(4) == 0u);
+    ASSERT_TRUE(List_::fill(1E5, 7).count(7) == 1E5);
+}
+
+TYPED_TEST(ListTest, IndexOfReturnsSizeForMissingElement) {
+    using List_ = typename TestFixture::List_;
+
+    List_ list{5, 4, 3, 4};
+    ASSERT_TRUE(list.indexOf(5) == 0u);
+    ASSERT_TRUE(list.indexOf(4) == 1u);
+    ASSERT_TRUE(list.indexOf(3) == 2u);
+    ASSERT_TRUE(list.indexOf(1) == list.size());
+}
+
+TYPED_TEST(ListTest, MinMaxFindExtremeElements) {
+    using List_ = typename TestFixture::List_;
+
+    List_ list{3, 1, 4, 1, 5, 9, 2, 6};
+    ASSERT_TRUE(list.min() == 1);
+    ASSERT_TRUE(list.max() == 9);
+    ASSERT_TRUE(List_(7).min() == 7);
+    ASSERT_TRUE(List_(7).max() == 7);
+}
+
+TYPED_TEST(ListTest, ListsOfDifferentSizeAreNotEqual) {
+    using List_ = typename TestFixture::List_;
+
+    List_ list{1, 2, 3};
+    ASSERT_TRUE(list != list.tail());
+    ASSERT_TRUE(list.tail() != list);
+}
+
+TYPED_TEST(ListTest, LargeListsCompareWithoutStackOverflow) {
+    using List_ = typename TestFixture::List_;
+
+    List_ list_a = List_::fill(1E5, 1);
+    List_ list_b = List_::fill(1E5, 1);
+    ASSERT_TRUE(list_a == list_b);
+    ASSERT_TRUE(list_a.insert(2) != list_b.insert(3));
+    ASSERT_TRUE(list_a.insert(2) == list_a.insert(2));
+}
+
+TYPED_TEST(ListTest, ConstructsListFromRange) {
+    using List_ = typename TestFixture::List_;
+
+    const TypeParam values[] = {1, 2, 3};
+    List_ list(std::begin(values), std::end(values));
+    List_ listProper{1, 2, 3};
+
+    ASSERT_TRUE(list == listProper);
+    ASSERT_THROW(List_(values, values), invalid_argument);
+}
+
+TYPED_TEST(ListTest, ConstructsListFromForwardRange) {
+    using List_ = typename TestFixture::List_;
+
+    const std::forward_list<TypeParam> values{1, 2, 3};
+    List_ list(values.begin(), values.end());
+    List_ listProper{1, 2, 3};
+
+    ASSERT_TRUE(list == listProper);
+    ASSERT_TRUE(List_(listProper.begin(), listProper.end()) == listProper);
+    ASSERT_THROW(List_(values.end(), values.end()), invalid_argument);
+}
+
+TEST(ListInputRangeTest, ConstructsListFromInputRange) {
+    std::istringstream input{"1 2 3"};
+    const List<const int> list{std::istream_iterator<int>{input},
+                               std::istream_iterator<int>{}};
+
+    ASSERT_TRUE(list == List<const int>({1, 2, 3}));
+}
+
+TYPED_TEST(ListTest, SharedCountsCommonTailNodes) {
+    using List_ = typename TestFixture::List_;
+
+    List_ list{1, 2, 3};
+    ASSERT_TRUE(list.shared(list) == 3);
+    ASSERT_TRUE(list.insert(0).shared(list) == 3);
+    ASSERT_TRUE(list.tail().shared(list) == 2);
+    ASSERT_TRUE(list.remove(1).shared(list) == 1);
+    ASSERT_TRUE(list.shared(List_{1, 2, 3}) == 0);
+}
+
+TYPED_TEST(ListTest, GenerateUsesIndexOfNode) {
+    using List_ = typename TestFixture::List_;
+
+    List_ list = List_::generate(5, [](size_t index) {
+        return TypeParam(index + 1);
+    });
+    List_ listProper{1, 2, 3, 4, 5};
+
+    ASSERT_TRUE(list == listProper);
+    ASSERT_THROW(List_::generate(0, [](size_t) { return 0; }),
+                 invalid_argument);
+}
+
+TEST(ListParallelTest, ConstructsLargeListsInParallel) {
+    using List_ = const List<const int>;
+
+    const size_t size = 1E6;
+    std::vector<int> values(size);
+    for (size_t i = 0; i < size; ++i) {
+        values[i] = int(i * 7);
+    }
+    List_ list(values.begin(), values.end());
+    List_ generated = List_::generate(size, [](size_t index) {
+        return int(index * 7);
+    });
+
+    ASSERT_TRUE(list.size() == size);
+    ASSERT_TRUE(list == generated);
+    ASSERT_TRUE(std::equal(list.begin(), list.end(), values.begin()));
+    ASSERT_TRUE(List_::fill(size, 3).count(3) == size);
+}
+
+TEST(ListParallelTest, LinksSegmentsOfParallelConstruction) {
+    using List_ = const List<const int>;
+
+    const size_t size = 1 << 18;
+    List_ list = List_::generate(size, [](size_t index) {
+        return int(index * 7);
+    }, 4);
+
+    std::vector<List<const int>> tails;
+    tails.reserve(size);
+    tails.push_back(list);
+    while (tails.back().size() > 1) {
+        tails.push_back(tails.back().tail());
+    }
+    ASSERT_TRUE(tails.size() == size);
+    for (size_t i = 0; i < size; ++i) {
+        ASSERT_TRUE(tails[i].size() == size - i);
+        ASSERT_TRUE(tails[i].head() == int(i * 7));
+    }
+    ASSERT_TRUE(List_::fill(size, 3, 4).count(3) == size);
+}
+
+TEST(ListParallelTest, FailedConstructionRethrowsException) {
+    using List_ = const List<const int>;
+
+    ASSERT_THROW(List_::generate(1E6, [](size_t index) {
+        if (index == 654321) {
+            throw std::runtime_error("Generation failed");
+        }
+        return int(index);
+    }), std::runtime_error);
+}
+
+TEST(ListParallelTest, FailedSegmentRethrowsException) {
+    using List_ = const List<const int>;
+
+    const size_t size = 1 << 18;
+    for (size_t failed : {size_t{0}, size / 4, size * 5 / 8, size - 1}) {
+        ASSERT_THROW(List_::generate(size, [failed](size_t index) {
+            if (index == failed) {
+                throw std::runtime_error("Generation failed");
+            }
+            return int(index);
+        }, 4), std::runtime_error);
+    }
+}
@@ -1,4 +1,5 @@
 #include "gtest/gtest.h"
+#include "testtypes.hpp"
 #include "list.hpp"
 
 template<typename T> class ListTest : public ::testing::Test {
@@ -13,10 +14,4 @@ template<typename T> class ListTest : public ::testing::Test {
         virtual void TearDown() {};
 };
 
-typedef ::testing::Types<
-    char, short, int, long, long long,
-    unsigned char, unsigned short, unsigned int,
-    unsigned long, unsigned long long
-> MyTypes;
-
-TYPED_TEST_CASE(ListTest, MyTypes);
+TYPED_TEST_CASE(ListTest, ValueTypes);
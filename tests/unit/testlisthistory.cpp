@@ -0,0 +1,100 @@
+#include "testlisthistory.hpp"
+
+TEST_F(ListHistoryTest, RecordsOperationsAsVersions) {
+    History_ history(List_{1, 2, 3}, -1);
+    history.insert(0);
+    history.remove(3);
+    history.concat(List_{4, 5});
+
+    ASSERT_TRUE(history.first() == 0);
+    ASSERT_TRUE(history.last() == 3);
+    ASSERT_TRUE(history.version() == 3);
+    ASSERT_TRUE(history.current() == List_({0, 1, 2, 4, 5}));
+    ASSERT_TRUE(history.checkout(0) == List_({1, 2, 3}));
+    ASSERT_TRUE(history.checkout(1) == List_({0, 1, 2, 3}));
+    ASSERT_TRUE(history.checkout(2) == List_({0, 1, 2}));
+    ASSERT_THROW(history.checkout(4), invalid_argument);
+}
+
+TEST_F(ListHistoryTest, ReportsMemoryOfUnsharedNodes) {
+    History_ history(List_{1, 2, 3, 4}, -1);
+    history.insert(0);
+    history.remove();
+    history.insert(9, 2);
+    history.concat(List_{5, 6});
+
+    ASSERT_TRUE(history.memory(0) == 4 * NODE);
+    ASSERT_TRUE(history.memory(1) == 1 * NODE);
+    ASSERT_TRUE(history.memory(2) == 0);
+    ASSERT_TRUE(history.memory(3) == 3 * NODE);
+    ASSERT_TRUE(history.memory(4) == 7 * NODE);
+    ASSERT_TRUE(history.memory() == 15 * NODE);
+}
+
+TEST_F(ListHistoryTest, RecordingAfterCheckoutDiscardsNewerVersions) {
+    History_ history(List_{1, 2}, -1);
+    history.insert(3);
+    history.insert(4);
+    history.checkout(0);
+    history.insert(5, 2);
+
+    ASSERT_TRUE(history.last() == 1);
+    ASSERT_TRUE(history.current() == List_({1, 2, 5}));
+    ASSERT_TRUE(history.memory() == 5 * NODE);
+}
+
+TEST_F(ListHistoryTest, RejectsRemovingOnlyElement) {
+    History_ history(List_{1, 2}, -1);
+    history.remove();
+    ASSERT_THROW(history.remove(), invalid_argument);
+    ASSERT_TRUE(history.last() == 1);
+    ASSERT_TRUE(history.current() == List_({2}));
+}
+
+TEST_F(ListHistoryTest, EvictsOldestVersionsUnderBudget) {
+    History_ history(List_::fill(10, 1), 20 * NODE);
+    for (int i = 0; i < 50; ++i) {
+        history.remove();
+        history.insert(i);
+        ASSERT_TRUE(history.memory() <= 20 * NODE);
+    }
+    ASSERT_TRUE(history.first() > 0);
+    ASSERT_TRUE(history.current().size() == 10);
+    ASSERT_THROW(history.checkout(history.first() - 1), invalid_argument);
+    ASSERT_TRUE(history.memory(history.first())
+                == history.checkout(history.first()).size() * NODE);
+}
+
+TEST_F(ListHistoryTest, KeepsCheckedOutVersionOverBudget) {
+    History_ history(List_::fill(100, 1), 20 * NODE);
+    history.insert(2);
+    ASSERT_TRUE(history.first() == history.last());
+    ASSERT_TRUE(history.memory() == 101 * NODE);
+}
+
+TEST_F(ListHistoryTest, ReclaimsEvictedNodesGradually) {
+    History_ history(List_::fill(1000, 1), 1001 * NODE);
+    history.record(List_{1, 2});
+    ASSERT_TRUE(history.first() == 1);
+    ASSERT_TRUE(history.pending() == 1000 - 3);
+    ASSERT_TRUE(history.memory() == 999 * NODE);
+    history.insert(3);
+    ASSERT_TRUE(history.first() == 1);
+    ASSERT_TRUE(history.pending() == 1000 - 5);
+    history.collect();
+    ASSERT_TRUE(history.pending() == 0);
+    ASSERT_TRUE(history.current() == List_({3, 1, 2}));
+}
+
+TEST_F(ListHistoryTest, BoundsEvictedNodesByBudget) {
+    History_ history(List_::fill(100000, 1), 100 * NODE);
+    history.record(List_{1, 2});
+    ASSERT_TRUE(history.first() == 1);
+    ASSERT_TRUE(history.memory() <= 100 * NODE);
+    for (int i = 0; i < 200; ++i) {
+        history.remove();
+        history.insert(i);
+        ASSERT_TRUE(history.memory() <= 100 * NODE);
+        ASSERT_TRUE(history.pending() <= 100);
+    }
+}
@@ -0,0 +1,14 @@
+#include "gtest/gtest.h"
+#include "listhistory.hpp"
+
+class ListHistoryTest : public ::testing::Test {
+    public:
+        using List_ = const List<const int>;
+        using History_ = ListHistory<const int>;
+        static const size_t NODE = List<const int>::nodeSize();
+    protected:
+        ListHistoryTest() {};
+        virtual ~ListHistoryTest() {};
+        virtual void SetUp() {};
+        virtual void TearDown() {};
+};
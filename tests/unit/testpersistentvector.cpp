@@ -0,0 +1,116 @@
+#include <vector>
+
+#include "testpersistentvector.hpp"
+
+/**
+ * Large enough to need three levels of the trie.
+ */
+static const size_t LARGE = 32 * 32 * 32 + 100;
+
+TYPED_TEST(PersistentVectorTest, DefaultConstructorCreatesEmpty) {
+    using Vector_ = typename TestFixture::Vector_;
+
+    Vector_ vector;
+    ASSERT_TRUE(vector.size() == 0);
+    ASSERT_TRUE(vector.begin() == vector.end());
+    ASSERT_THROW(vector.at(0), invalid_argument);
+    ASSERT_THROW(vector.popBack(), invalid_argument);
+}
+
+TYPED_TEST(PersistentVectorTest, ConstructsFromInitializerList) {
+    using Vector_ = typename TestFixture::Vector_;
+
+    Vector_ vector{1, 2, 3};
+    ASSERT_TRUE(vector.size() == 3);
+    ASSERT_TRUE(vector.at(0) == 1);
+    ASSERT_TRUE(vector.at(2) == 3);
+    ASSERT_THROW(vector.at(3), invalid_argument);
+}
+
+TYPED_TEST(PersistentVectorTest, PushBackKeepsPreviousVersions) {
+    using Vector_ = typename TestFixture::Vector_;
+
+    std::vector<typename std::remove_const<Vector_>::type> versions(1);
+    for (size_t i = 0; i < LARGE; ++i) {
+        versions.push_back(versions.back().pushBack(i));
+    }
+    for (size_t size = 0; size <= LARGE; size += 997) {
+        ASSERT_TRUE(versions[size].size() == size);
+        for (size_t i = 0; i < size; i += 31) {
+            ASSERT_TRUE(versions[size].at(i) == TypeParam(i));
+        }
+    }
+    const Vector_& last = versions.back();
+    for (size_t i = 0; i < LARGE; ++i) {
+        ASSERT_TRUE(last.at(i) == TypeParam(i));
+    }
+}
+
+TYPED_TEST(PersistentVectorTest, PopBackRestoresPreviousVersions) {
+    using Vector_ = typename TestFixture::Vector_;
+
+    std::vector<TypeParam> values;
+    for (size_t i = 0; i < LARGE; ++i) {
+        values.push_back(i);
+    }
+    std::vector<typename std::remove_const<Vector_>::type> versions;
+    versions.emplace_back(values.begin(), values.end());
+    while (versions.back().size()) {
+        versions.push_back(versions.back().popBack());
+    }
+    ASSERT_TRUE(versions.size() == LARGE + 1);
+    for (size_t i = 0; i <= LARGE; i += 97) {
+        Vector_ expected(values.begin(), values.end() - i);
+        ASSERT_TRUE(versions[i] == expected);
+    }
+}
+
+TYPED_TEST(PersistentVectorTest, SetReplacesSingleValue) {
+    using Vector_ = typename TestFixture::Vector_;
+
+    std::vector<TypeParam> values(LARGE, 1);
+    Vector_ vector(values.begin(), values.end());
+    for (size_t i : {size_t{0}, size_t{31}, size_t{32}, size_t{1025},
+                     LARGE - 33, LARGE - 1}) {
+        Vector_ changed = vector.set(i, 2);
+        ASSERT_TRUE(changed.at(i) == 2);
+        ASSERT_TRUE(vector.at(i) == 1);
+        ASSERT_TRUE(changed.size() == vector.size());
+        ASSERT_TRUE(changed != vector);
+        ASSERT_TRUE(changed.set(i, 1) == vector);
+    }
+    ASSERT_THROW(vector.set(LARGE, 2), invalid_argument);
+}
+
+TYPED_TEST(PersistentVectorTest, IterationVisitsAllValuesInOrder) {
+    using Vector_ = typename TestFixture::Vector_;
+
+    std::vector<TypeParam> values;
+    for (size_t i = 0; i < LARGE; ++i) {
+        values.push_back(i);
+    }
+    Vector_ vector(values.begin(), values.end());
+    ASSERT_TRUE(std::equal(vector.begin(), vector.end(), values.begin()));
+
+    auto it = vector.end();
+    for (size_t i = LARGE; i-- > 0;) {
+        ASSERT_TRUE(*--it == TypeParam(i));
+    }
+    ASSERT_TRUE(it == vector.begin());
+}
+
+TYPED_TEST(PersistentVectorTest, ConvertsToAndFromList) {
+    using Vector_ = typename TestFixture::Vector_;
+    using List_ = typename TestFixture::List_;
+
+    List_ list{1, 2, 3, 4, 5};
+    Vector_ vector(list);
+    ASSERT_TRUE(vector == Vector_({1, 2, 3, 4, 5}));
+    ASSERT_TRUE(vector.toList() == list);
+    ASSERT_TRUE(vector.pushBack(6).toList() == list.append(6));
+    ASSERT_THROW(Vector_().toList(), invalid_argument);
+
+    List_ large = List_::fill(LARGE, 7);
+    ASSERT_TRUE(Vector_(large).size() == LARGE);
+    ASSERT_TRUE(Vector_(large).toList() == large);
+}
@@ -0,0 +1,16 @@
+#include "gtest/gtest.h"
+#include "testtypes.hpp"
+#include "persistentvector.hpp"
+
+template<typename T> class PersistentVectorTest : public ::testing::Test {
+    public:
+        using Vector_ = const PersistentVector<const T>;
+        using List_ = const List<const T>;
+    protected:
+        PersistentVectorTest() {};
+        virtual ~PersistentVectorTest() {};
+        virtual void SetUp() {};
+        virtual void TearDown() {};
+};
+
+TYPED_TEST_CASE(PersistentVectorTest, ValueTypes);
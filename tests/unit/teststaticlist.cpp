@@ -0,0 +1,107 @@
+#include <algorithm>
+
+#include "list.hpp"
+
+#include "teststaticlist.hpp"
+
+TYPED_TEST(StaticListTest, ReadsAreEvaluatedAtCompileTime) {
+    using List_ = typename TestFixture::List_;
+
+    static constexpr TypeParam values[] = {3, 1, 4, 1, 5};
+    constexpr List_ list{values};
+
+    static_assert(list.size() == 5, "Size should be known");
+    static_assert(list.head() == 3, "Head should be known");
+    static_assert(list.tail().head() == 1, "Tail should be known");
+    static_assert(list.count(1) == 2, "Count should be known");
+    static_assert(list.indexOf(4) == 2, "Index should be known");
+    static_assert(list.min() == 1 && list.max() == 5,
+                  "Extreme values should be known");
+    static_assert(list.drop(2).head() == 4, "Drop should be known");
+    static_assert(list == list, "Equality should be known");
+}
+
+TYPED_TEST(StaticListTest, IterationVisitsAllElementsInOrder) {
+    using List_ = typename TestFixture::List_;
+
+    static constexpr TypeParam values[] = {1, 2, 3, 4, 5};
+    constexpr List_ list{values};
+    TypeParam expected = 1;
+    for (const auto& value : list) {
+        ASSERT_TRUE(value == expected++);
+    }
+    ASSERT_TRUE(expected == 6);
+}
+
+TYPED_TEST(StaticListTest, EqualityComparesValues) {
+    using List_ = typename TestFixture::List_;
+
+    static constexpr TypeParam values_a[] = {1, 2, 3};
+    static constexpr TypeParam values_b[] = {0, 1, 2, 3};
+    static constexpr TypeParam values_c[] = {1, 2, 4};
+    constexpr List_ list_a{values_a};
+    constexpr List_ list_b{values_b};
+    constexpr List_ list_c{values_c};
+
+    ASSERT_TRUE(list_a == list_b.tail());
+    ASSERT_TRUE(list_a != list_b);
+    ASSERT_TRUE(list_a != list_c);
+}
+
+TYPED_TEST(StaticListTest, DropAndTailCanReachEmptyList) {
+    using List_ = typename TestFixture::List_;
+
+    static constexpr TypeParam values[] = {1, 2};
+    constexpr List_ list{values};
+
+    ASSERT_TRUE(list.tail().tail().size() == 0);
+    ASSERT_TRUE(list.drop(5).size() == 0);
+    ASSERT_THROW(list.drop(2).head(), invalid_argument);
+}
+
+TYPED_TEST(StaticListTest, SliceSelectsInclusiveRange) {
+    using List_ = typename TestFixture::List_;
+
+    static constexpr TypeParam values[] = {1, 2, 3, 4, 5};
+    static constexpr TypeParam sliced[] = {2, 3};
+    static constexpr TypeParam suffix[] = {3, 4, 5};
+    constexpr List_ list{values};
+
+    ASSERT_TRUE(list.slice(1, 2) == List_{sliced});
+    ASSERT_TRUE(list.slice(2) == List_{suffix});
+    ASSERT_THROW(list.slice(3, 2), invalid_argument);
+}
+
+TYPED_TEST(StaticListTest, ImmortalNodesServeAsTailOfRuntimeList) {
+    using List_ = typename TestFixture::List_;
+    using RuntimeList = const List<const TypeParam>;
+
+    static constexpr TypeParam values[] = {2, 3, 4};
+    static const typename List<const TypeParam>::template Immortal<3>
+        nodes{values};
+    constexpr List_ table{values};
+
+    ASSERT_TRUE(std::equal(table.begin(), table.end(),
+                           nodes.list().begin()));
+    RuntimeList list(1, nodes.list());
+    RuntimeList expected{1, 2, 3, 4};
+    ASSERT_TRUE(list == expected);
+    ASSERT_TRUE(list.tail() == nodes.list());
+    ASSERT_TRUE(nodes.list().insert(1) == expected);
+    ASSERT_TRUE(nodes.list().insert(5, 1) == RuntimeList({2, 5, 3, 4}));
+    ASSERT_TRUE(nodes.list().append(5) == RuntimeList({2, 3, 4, 5}));
+    ASSERT_TRUE(nodes.list().remove(1) == RuntimeList({2, 4}));
+    ASSERT_TRUE(nodes.list() == RuntimeList({2, 3, 4}));
+}
+
+TYPED_TEST(StaticListTest, DropRemovesExactAmountOfElements) {
+    using List_ = typename TestFixture::List_;
+
+    static constexpr TypeParam values[] = {1, 2, 3, 4};
+    static constexpr TypeParam dropped[] = {2, 3, 4};
+    constexpr List_ list{values};
+
+    ASSERT_TRUE(list.drop(0) == list);
+    ASSERT_TRUE(list.drop(1) == List_{dropped});
+    ASSERT_TRUE(list.slice(0) == list);
+}
@@ -0,0 +1,15 @@
+#include "gtest/gtest.h"
+#include "testtypes.hpp"
+#include "staticlist.hpp"
+
+template<typename T> class StaticListTest : public ::testing::Test {
+    public:
+        using List_ = const StaticList<const T>;
+    protected:
+        StaticListTest() {};
+        virtual ~StaticListTest() {};
+        virtual void SetUp() {};
+        virtual void TearDown() {};
+};
+
+TYPED_TEST_CASE(StaticListTest, ValueTypes);
@@ -0,0 +1,15 @@
+#ifndef TESTTYPES_HPP
+#define TESTTYPES_HPP
+
+#include "gtest/gtest.h"
+
+/**
+ * Types of values that typed tests of containers are run with.
+ */
+typedef ::testing::Types<
+    char, short, int, long, long long,
+    unsigned char, unsigned short, unsigned int,
+    unsigned long, unsigned long long
+> ValueTypes;
+
+#endif